@@ -1,5 +1,10 @@
 #pragma once
+#include <algorithm>
 #include <cstdlib>
+#include <limits>
+#include <new>
+#include <utility>
+#include "buffer_pool.h"
 
 template <typename Type>
 class ArrayPtr {
@@ -9,13 +14,47 @@ public:
 
     // Создаёт в куче массив из size элементов типа Type.
     // Если size == 0, поле raw_ptr_ должно быть равно nullptr
+    // Если включён BufferPool, память берётся из пула
     explicit ArrayPtr(size_t size) {
-        if (size != 0) {
+        if (size == 0) {
+            return;
+        }
+        if (BufferPool::IsPoolable<Type>() && BufferPool::Instance().IsEnabled()) {
+            AllocatePooled(size);
+        }
+        else {
             Type* temp = new Type[size]{};
             raw_ptr_ = &temp[0];
         }
     }
 
+    // Выделяет неинициализированную память под size элементов и передаёт её в initialize(data),
+    // которая должна создать все size элементов. Если initialize выбрасывает исключение,
+    // она не должна оставлять созданных элементов; память при этом освобождается.
+    // Память не берётся из BufferPool: страницы впервые затрагивает initialize,
+    // поэтому она определяет, на каком узле NUMA они окажутся
+    template <typename Initializer>
+    ArrayPtr(size_t size, Initializer initialize) {
+        static_assert(BufferPool::IsPoolable<Type>(), "over-aligned types are not supported");
+        if (size == 0) {
+            return;
+        }
+        if (size > std::numeric_limits<size_t>::max() / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        Type* data = static_cast<Type*>(::operator new(size * sizeof(Type)));
+        try {
+            initialize(data);
+        }
+        catch (...) {
+            ::operator delete(data);
+            throw;
+        }
+        raw_ptr_ = data;
+        size_ = size;
+        free_ = &FreeRaw;
+    }
+
     // Конструктор из сырого указателя, хранящего адрес массива в куче либо nullptr
     explicit ArrayPtr(Type* raw_ptr) noexcept {
         raw_ptr_ = raw_ptr;
@@ -31,7 +70,7 @@ public:
     }
 
     ~ArrayPtr() {
-        delete[] Release();
+        Free();
     }
 
     // Запрещаем присваивание
@@ -44,7 +83,15 @@ public:
 
     // Прекращает владением массивом в памяти, возвращает значение адреса массива
     // После вызова метода указатель на массив должен обнулиться
-    [[nodiscard]] Type* Release() noexcept {
+    // Возвращённый массив всегда освобождается через delete[]: массив из BufferPool или сырой памяти
+    // для этого переносится в новый массив из new[]. Если перенос выбрасывает исключение,
+    // ArrayPtr продолжает владеть исходным массивом
+    [[nodiscard]] Type* Release() {
+        if (free_ != &FreeArray) {
+            ArrayPtr array(new Type[size_]{});
+            std::move(raw_ptr_, raw_ptr_ + size_, array.Get());
+            swap(array);
+        }
         Type* ptr = raw_ptr_;
         raw_ptr_ = nullptr;
         return ptr;
@@ -76,8 +123,73 @@ public:
     // Обменивается значениям указателя на массив с объектом other
     void swap(ArrayPtr& other) noexcept {
         std::swap(raw_ptr_, other.raw_ptr_);
+        std::swap(size_, other.size_);
+        std::swap(block_bytes_, other.block_bytes_);
+        std::swap(free_, other.free_);
     }
 
 private:
+    // Берёт блок из BufferPool и инициализирует в нём size элементов значением по умолчанию
+    void AllocatePooled(size_t size) {
+        if (size > std::numeric_limits<size_t>::max() / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        BufferPool& pool = BufferPool::Instance();
+        size_t block_bytes = 0;
+        Type* data = static_cast<Type*>(pool.Allocate(size * sizeof(Type), block_bytes));
+        size_t constructed = 0;
+        try {
+            for (; constructed < size; ++constructed) {
+                new (data + constructed) Type{};
+            }
+        }
+        catch (...) {
+            Destroy(data, constructed);
+            pool.Deallocate(data, block_bytes);
+            throw;
+        }
+        raw_ptr_ = data;
+        size_ = size;
+        block_bytes_ = block_bytes;
+        free_ = &FreePooled;
+    }
+
+    static void Destroy(Type* data, size_t size) noexcept {
+        for (size_t i = 0; i < size; ++i) {
+            data[i].~Type();
+        }
+    }
+
+    // Функции освобождения для каждого способа выделения памяти.
+    // Каждый конструктор запоминает свою, поэтому delete[] вызывается только для массивов из new[]
+    using FreeFn = void (*)(Type* data, size_t size, size_t block_bytes) noexcept;
+
+    static void FreeArray(Type* data, size_t, size_t) noexcept {
+        delete[] data;
+    }
+
+    static void FreePooled(Type* data, size_t size, size_t block_bytes) noexcept {
+        Destroy(data, size);
+        BufferPool::Instance().Deallocate(data, block_bytes);
+    }
+
+    static void FreeRaw(Type* data, size_t size, size_t) noexcept {
+        Destroy(data, size);
+        ::operator delete(data);
+    }
+
+    void Free() noexcept {
+        free_(raw_ptr_, size_, block_bytes_);
+        raw_ptr_ = nullptr;
+        size_ = 0;
+        block_bytes_ = 0;
+        free_ = &FreeArray;
+    }
+
     Type* raw_ptr_ = nullptr;
+    // Для массивов из BufferPool или сырой памяти — число элементов; для массивов из new[] равно нулю
+    size_t size_ = 0;
+    // Для массивов из BufferPool — размер блока, иначе ноль
+    size_t block_bytes_ = 0;
+    FreeFn free_ = &FreeArray;
 };
\ No newline at end of file
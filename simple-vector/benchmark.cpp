@@ -0,0 +1,219 @@
+#include "simple_vector.h"
+#include "compressed_int_vector.h"
+#include "ring_buffer.h"
+#include "vector_expression.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Очередь на SimpleVector под мьютексом: PushBack в конец и Erase(begin()) из начала
+template <typename Type>
+class LockedVectorQueue {
+public:
+    explicit LockedVectorQueue(size_t capacity) :
+        capacity_(capacity)
+    {
+    }
+
+    size_t PushN(Type* items, size_t count) {
+        lock_guard guard(mutex_);
+        size_t pushed = 0;
+        for (; pushed < count && items_.GetSize() < capacity_; ++pushed) {
+            items_.PushBack(items[pushed]);
+        }
+        return pushed;
+    }
+
+    size_t PopN(Type* out, size_t count) {
+        lock_guard guard(mutex_);
+        size_t popped = 0;
+        for (; popped < count && !items_.IsEmpty(); ++popped) {
+            out[popped] = items_[0];
+            items_.Erase(items_.begin());
+        }
+        return popped;
+    }
+
+private:
+    const size_t capacity_;
+    mutex mutex_;
+    SimpleVector<Type> items_;
+};
+
+// Прогоняет items_per_producer элементов через очередь пакетами по batch штук
+// и возвращает пропускную способность в миллионах элементов в секунду
+template <typename Queue>
+double MeasureQueue(size_t producers, size_t consumers, size_t batch) {
+    const size_t items_per_producer = 1 << 20;
+    const size_t total = items_per_producer * producers;
+    Queue queue(1024);
+    atomic<size_t> consumed = 0;
+
+    const auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            vector<uint64_t> items(batch);
+            for (size_t i = 0; i < items_per_producer; i += batch) {
+                const size_t count = min(batch, items_per_producer - i);
+                size_t pushed = 0;
+                while (pushed < count) {
+                    const size_t n = queue.PushN(items.data() + pushed, count - pushed);
+                    if (n == 0) {
+                        this_thread::yield();
+                    }
+                    pushed += n;
+                }
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            vector<uint64_t> items(batch);
+            while (consumed.load(memory_order_relaxed) < total) {
+                const size_t n = queue.PopN(items.data(), batch);
+                if (n == 0) {
+                    this_thread::yield();
+                }
+                consumed += n;
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return total / elapsed.count() / 1e6;
+}
+
+void BenchmarkRingBuffers() {
+    cout << "Ring buffers, million items per second"s << endl;
+    for (size_t batch : { 1, 64 }) {
+        cout << "batch "s << batch << endl;
+        cout << "  SPSC 1x1: "s << MeasureQueue<SpscRingBuffer<uint64_t>>(1, 1, batch) << endl;
+        const size_t max_threads = max(2u, thread::hardware_concurrency());
+        for (size_t threads = 1; threads * 2 <= max_threads; threads *= 2) {
+            cout << "  MPMC "s << threads << 'x' << threads << ": "s
+                 << MeasureQueue<MpmcRingBuffer<uint64_t>>(threads, threads, batch) << endl;
+            cout << "  locked SimpleVector "s << threads << 'x' << threads << ": "s
+                 << MeasureQueue<LockedVectorQueue<uint64_t>>(threads, threads, batch) << endl;
+        }
+    }
+    cout << endl;
+}
+
+// Вычисляет a = b * c + d через отдельный вектор на каждую операцию
+SimpleVector<double> MultiplyAddNaive(const SimpleVector<double>& b, const SimpleVector<double>& c,
+                                      const SimpleVector<double>& d) {
+    SimpleVector<double> product(b.GetSize());
+    for (size_t i = 0; i < b.GetSize(); ++i) {
+        product[i] = b[i] * c[i];
+    }
+    SimpleVector<double> sum(b.GetSize());
+    for (size_t i = 0; i < b.GetSize(); ++i) {
+        sum[i] = product[i] + d[i];
+    }
+    return sum;
+}
+
+template <typename Function>
+double MeasureMilliseconds(Function function) {
+    const auto start = chrono::steady_clock::now();
+    function();
+    const chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+void BenchmarkVectorExpressions() {
+    const size_t size = 10'000'000;
+    const int repeats = 10;
+    SimpleVector<double> b(size, 1.5);
+    SimpleVector<double> c(size, 2.0);
+    SimpleVector<double> d(size, 0.25);
+    SimpleVector<double> a(size);
+
+    cout << "a = b * c + d over "s << size << " doubles, ms per evaluation"s << endl;
+    cout << "  temporaries: "s << MeasureMilliseconds([&] {
+        for (int i = 0; i < repeats; ++i) {
+            a = MultiplyAddNaive(b, c, d);
+        }
+    }) / repeats << endl;
+    cout << "  hand-written loop: "s << MeasureMilliseconds([&] {
+        for (int i = 0; i < repeats; ++i) {
+            for (size_t j = 0; j < size; ++j) {
+                a[j] = b[j] * c[j] + d[j];
+            }
+        }
+    }) / repeats << endl;
+    cout << "  expression, in place: "s << MeasureMilliseconds([&] {
+        for (int i = 0; i < repeats; ++i) {
+            a = b * c + d;
+        }
+    }) / repeats << endl;
+    double sink = 0.0;
+    cout << "  expression, fresh vector: "s << MeasureMilliseconds([&] {
+        for (int i = 0; i < repeats; ++i) {
+            SimpleVector<double> fresh = b * c + d;
+            sink += fresh[i];
+        }
+    }) / repeats << endl;
+    cout << "  (checksum "s << sink << ')' << endl;
+    cout << endl;
+}
+
+void BenchmarkCompressedScan() {
+    const size_t size = 20'000'000;
+    const int repeats = 5;
+    SimpleVector<uint64_t> raw(size);
+    for (size_t i = 0; i < size; ++i) {
+        raw[i] = 1'000'000'000'000 + i * 3 + i % 7;
+    }
+    const CompressedIntVector<uint64_t> compressed(raw);
+
+    cout << "Sum of "s << size << " sorted uint64_t, ms per scan"s << endl;
+    cout << "  compressed size: "s << compressed.GetMemoryUsage() / 1e6 << " MB vs "s
+         << raw.GetSize() * sizeof(uint64_t) / 1e6 << " MB"s << endl;
+    uint64_t sink = 0;
+    cout << "  SimpleVector: "s << MeasureMilliseconds([&] {
+        for (int i = 0; i < repeats; ++i) {
+            for (uint64_t value : raw) {
+                sink += value;
+            }
+        }
+    }) / repeats << endl;
+    cout << "  CompressedIntVector iterator: "s << MeasureMilliseconds([&] {
+        for (int i = 0; i < repeats; ++i) {
+            for (uint64_t value : compressed) {
+                sink += value;
+            }
+        }
+    }) / repeats << endl;
+    cout << "  CompressedIntVector DecodeBlock: "s << MeasureMilliseconds([&] {
+        const size_t block_size = CompressedIntVector<uint64_t>::kBlockSize;
+        uint64_t block[block_size];
+        for (int i = 0; i < repeats; ++i) {
+            for (size_t b = 0; b < size / block_size; ++b) {
+                compressed.DecodeBlock(b, block);
+                for (uint64_t value : block) {
+                    sink += value;
+                }
+            }
+        }
+    }) / repeats << endl;
+    cout << "  (checksum "s << sink << ')' << endl << endl;
+}
+
+// Сборка: g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+int main() {
+    BenchmarkRingBuffers();
+    BenchmarkVectorExpressions();
+    BenchmarkCompressedScan();
+    return 0;
+}
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+// Ограничения на объём памяти, удерживаемой пулом
+struct BufferPoolOptions {
+    // Блоки большего размера (в байтах) в пул не возвращаются
+    size_t max_block_size = size_t{1} << 26;
+    // Сколько свободных блоков каждого класса хранит один поток
+    size_t max_local_blocks = 4;
+    // Сколько байт суммарно хранит один поток во всех своих списках
+    size_t max_local_bytes = size_t{1} << 25;
+    // Сколько байт суммарно хранит общий список
+    size_t max_global_bytes = size_t{1} << 28;
+};
+
+// Счётчики пула
+struct BufferPoolStats {
+    // Запросы, обслуженные из локального или общего списка
+    size_t hits = 0;
+    // Запросы, для которых пришлось выделять новую память
+    size_t misses = 0;
+    // Объём памяти в общем списке
+    size_t global_bytes = 0;
+    // Объём памяти в списках вызывающего потока
+    size_t local_bytes = 0;
+};
+
+// Пул буферов, разбитых на классы размеров по степеням двойки.
+// Освобождённый блок сначала попадает в список текущего потока,
+// при его переполнении — в общий список, а дальше освобождается.
+// По умолчанию выключен; ArrayPtr обращается к нему только после Enable(true)
+class BufferPool {
+public:
+    static BufferPool& Instance() {
+        static BufferPool pool;
+        return pool;
+    }
+
+    // Можно ли хранить в пуле массивы элементов типа Type
+    template <typename Type>
+    static constexpr bool IsPoolable() noexcept {
+        return alignof(Type) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    }
+
+    void Enable(bool enabled) noexcept {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool IsEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void SetOptions(const BufferPoolOptions& options) noexcept {
+        max_block_size_.store(options.max_block_size, std::memory_order_relaxed);
+        max_local_blocks_.store(options.max_local_blocks, std::memory_order_relaxed);
+        max_local_bytes_.store(options.max_local_bytes, std::memory_order_relaxed);
+        max_global_bytes_.store(options.max_global_bytes, std::memory_order_relaxed);
+    }
+
+    BufferPoolOptions GetOptions() const noexcept {
+        BufferPoolOptions options;
+        options.max_block_size = max_block_size_.load(std::memory_order_relaxed);
+        options.max_local_blocks = max_local_blocks_.load(std::memory_order_relaxed);
+        options.max_local_bytes = max_local_bytes_.load(std::memory_order_relaxed);
+        options.max_global_bytes = max_global_bytes_.load(std::memory_order_relaxed);
+        return options;
+    }
+
+    // Выделяет блок не меньше bytes байт, его настоящий размер записывает в block_bytes.
+    // Этот размер нужно передать в Deallocate
+    void* Allocate(size_t bytes, size_t& block_bytes) {
+        const size_t size_class = GetSizeClass(bytes);
+        block_bytes = GetClassBytes(size_class);
+        if (block_bytes < bytes || block_bytes > max_block_size_.load(std::memory_order_relaxed)) {
+            block_bytes = bytes;
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(bytes);
+        }
+
+        LocalLists& local = GetLocalLists();
+        if (void* block = Pop(local.lists[size_class])) {
+            local.bytes -= block_bytes;
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return block;
+        }
+        {
+            std::lock_guard guard(mutex_);
+            if (void* block = Pop(global_[size_class])) {
+                global_bytes_ -= block_bytes;
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return block;
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(block_bytes);
+    }
+
+    // Возвращает блок размером block_bytes в пул или освобождает его, если пул заполнен
+    void Deallocate(void* block, size_t block_bytes) noexcept {
+        const size_t size_class = GetSizeClass(block_bytes);
+        if (!IsEnabled() || GetClassBytes(size_class) != block_bytes
+            || block_bytes > max_block_size_.load(std::memory_order_relaxed)) {
+            ::operator delete(block);
+            return;
+        }
+
+        LocalLists& local = GetLocalLists();
+        if (local.lists[size_class].count < max_local_blocks_.load(std::memory_order_relaxed)
+            && local.bytes + block_bytes <= max_local_bytes_.load(std::memory_order_relaxed)) {
+            Push(local.lists[size_class], block);
+            local.bytes += block_bytes;
+            return;
+        }
+        DeallocateGlobal(block, size_class);
+    }
+
+    // Сразу освобождает блоки общего списка и списков текущего потока.
+    // Другие потоки освобождают свои списки при следующем обращении к пулу или при завершении;
+    // пока поток не обращается к пулу, его блоки остаются занятыми
+    void Trim() noexcept {
+        trim_epoch_.fetch_add(1, std::memory_order_release);
+        GetLocalLists();
+        std::lock_guard guard(mutex_);
+        for (FreeList& list : global_) {
+            Clear(list);
+        }
+        global_bytes_ = 0;
+    }
+
+    BufferPoolStats GetStats() const {
+        BufferPoolStats stats;
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        stats.local_bytes = GetLocalLists().bytes;
+        std::lock_guard guard(mutex_);
+        stats.global_bytes = global_bytes_;
+        return stats;
+    }
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    ~BufferPool() {
+        for (FreeList& list : global_) {
+            Clear(list);
+        }
+    }
+
+private:
+    // Наименьший класс — 64 байта, чтобы в свободном блоке поместился указатель на следующий
+    static constexpr size_t kMinClassShift = 6;
+    static constexpr size_t kClassCount = sizeof(size_t) * 8 - kMinClassShift;
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct FreeList {
+        FreeBlock* head = nullptr;
+        size_t count = 0;
+    };
+
+    // Списки потока; при завершении потока переносятся в общий список или освобождаются
+    struct LocalLists {
+        FreeList lists[kClassCount];
+        size_t bytes = 0;
+        // Номер последнего Trim, учтённого этим потоком
+        size_t trim_epoch = 0;
+
+        void Clear() noexcept {
+            for (FreeList& list : lists) {
+                BufferPool::Clear(list);
+            }
+            bytes = 0;
+        }
+
+        ~LocalLists() {
+            BufferPool& pool = Instance();
+            if (trim_epoch != pool.trim_epoch_.load(std::memory_order_acquire)) {
+                Clear();
+                return;
+            }
+            for (size_t i = 0; i < kClassCount; ++i) {
+                while (void* block = Pop(lists[i])) {
+                    pool.DeallocateGlobal(block, i);
+                }
+            }
+        }
+    };
+
+    BufferPool() = default;
+
+    // Кладёт блок в общий список или освобождает его, если список заполнен
+    void DeallocateGlobal(void* block, size_t size_class) noexcept {
+        const size_t block_bytes = GetClassBytes(size_class);
+        {
+            std::lock_guard guard(mutex_);
+            if (global_bytes_ + block_bytes <= max_global_bytes_.load(std::memory_order_relaxed)) {
+                Push(global_[size_class], block);
+                global_bytes_ += block_bytes;
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+    static size_t GetSizeClass(size_t bytes) noexcept {
+        size_t size_class = 0;
+        while (GetClassBytes(size_class) < bytes && size_class + 1 < kClassCount) {
+            ++size_class;
+        }
+        return size_class;
+    }
+
+    static size_t GetClassBytes(size_t size_class) noexcept {
+        return size_t{1} << (size_class + kMinClassShift);
+    }
+
+    // Возвращает списки текущего потока, предварительно очистив их, если с прошлого обращения был Trim
+    LocalLists& GetLocalLists() const noexcept {
+        static thread_local LocalLists local;
+        const size_t epoch = trim_epoch_.load(std::memory_order_acquire);
+        if (local.trim_epoch != epoch) {
+            local.Clear();
+            local.trim_epoch = epoch;
+        }
+        return local;
+    }
+
+    static void Push(FreeList& list, void* block) noexcept {
+        FreeBlock* free_block = static_cast<FreeBlock*>(block);
+        free_block->next = list.head;
+        list.head = free_block;
+        ++list.count;
+    }
+
+    static void* Pop(FreeList& list) noexcept {
+        FreeBlock* block = list.head;
+        if (block != nullptr) {
+            list.head = block->next;
+            --list.count;
+        }
+        return block;
+    }
+
+    static void Clear(FreeList& list) noexcept {
+        while (void* block = Pop(list)) {
+            ::operator delete(block);
+        }
+    }
+
+    std::atomic<bool> enabled_ = false;
+    std::atomic<size_t> max_block_size_ = BufferPoolOptions{}.max_block_size;
+    std::atomic<size_t> max_local_blocks_ = BufferPoolOptions{}.max_local_blocks;
+    std::atomic<size_t> max_local_bytes_ = BufferPoolOptions{}.max_local_bytes;
+    std::atomic<size_t> max_global_bytes_ = BufferPoolOptions{}.max_global_bytes;
+    std::atomic<size_t> hits_ = 0;
+    std::atomic<size_t> misses_ = 0;
+    std::atomic<size_t> trim_epoch_ = 0;
+
+    mutable std::mutex mutex_;
+    FreeList global_[kClassCount];
+    size_t global_bytes_ = 0;
+};
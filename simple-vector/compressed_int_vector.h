@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "simple_vector.h"
+
+// Вектор беззнаковых целых, хранящий значения блоками по kBlockSize элементов.
+// Каждый заполненный блок кодируется относительно своего минимума (frame of reference)
+// и упаковывается в минимально достаточное число бит на элемент.
+// Последний неполный блок хранится несжатым, пока не заполнится
+template <typename Type = uint64_t>
+class CompressedIntVector {
+    static_assert(std::is_integral_v<Type> && std::is_unsigned_v<Type>
+                  && std::numeric_limits<Type>::digits <= 64,
+                  "CompressedIntVector stores unsigned integers up to 64 bits");
+
+public:
+    static constexpr size_t kBlockSize = 128;
+    // Сколько элементов итератор распаковывает за раз
+    static constexpr size_t kGroupSize = 16;
+
+    class ConstIterator;
+    using Iterator = ConstIterator;
+
+    CompressedIntVector() noexcept = default;
+
+    // Сжимает содержимое SimpleVector
+    explicit CompressedIntVector(const SimpleVector<Type>& values) {
+        for (const Type& value : values) {
+            PushBack(value);
+        }
+    }
+
+    // Добавляет элемент в конец вектора.
+    // Как только накапливается kBlockSize элементов, блок упаковывается
+    void PushBack(Type value) {
+        tail_[size_ % kBlockSize] = value;
+        ++size_;
+        if (size_ % kBlockSize == 0) {
+            SealTail();
+        }
+    }
+
+    // Возвращает элемент с индексом index, распаковывая только его
+    Type operator[](size_t index) const noexcept {
+        assert(index < size_);
+        const size_t block_index = index / kBlockSize;
+        if (block_index == blocks_.GetSize()) {
+            return tail_[index % kBlockSize];
+        }
+        const Block& block = blocks_[block_index];
+        return block.base + static_cast<Type>(
+            Unpack(words_.begin() + block.offset, index % kBlockSize, block.width));
+    }
+
+    // Возвращает элемент с индексом index
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    Type At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("too much");
+        }
+        return (*this)[index];
+    }
+
+    // Возвращает количество элементов
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустой ли вектор
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Удаляет все элементы, сохраняя выделенную память
+    void Clear() noexcept {
+        words_.Clear();
+        blocks_.Clear();
+        size_ = 0;
+    }
+
+    // Возвращает объём памяти в байтах, занимаемый вектором вместе с буферами
+    size_t GetMemoryUsage() const noexcept {
+        return sizeof(*this)
+            + words_.GetCapacity() * sizeof(uint64_t)
+            + blocks_.GetCapacity() * sizeof(Block);
+    }
+
+    // Распаковывает все элементы в SimpleVector
+    SimpleVector<Type> ToSimpleVector() const {
+        SimpleVector<Type> result(size_);
+        for (size_t i = 0; i < blocks_.GetSize(); ++i) {
+            DecodeBlock(i, result.begin() + i * kBlockSize);
+        }
+        std::copy(tail_.begin(), tail_.begin() + size_ % kBlockSize,
+                  result.begin() + blocks_.GetSize() * kBlockSize);
+        return result;
+    }
+
+    // Распаковывает блок с индексом block_index целиком в out.
+    // Для каждой ширины упаковки есть своя развёрнутая функция без ветвлений,
+    // в которой все сдвиги и маски — константы времени компиляции
+    void DecodeBlock(size_t block_index, Type* out) const noexcept {
+        assert(block_index < blocks_.GetSize());
+        const Block& block = blocks_[block_index];
+        kUnpackTable[block.width](words_.begin() + block.offset, block.base, out);
+    }
+
+    ConstIterator begin() const {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const {
+        return ConstIterator(this, size_);
+    }
+
+    ConstIterator cbegin() const {
+        return begin();
+    }
+
+    ConstIterator cend() const {
+        return end();
+    }
+
+    // Последовательный итератор: распаковывает по kGroupSize элементов за раз
+    // в собственный буфер при переходе в новую группу. Разыменование только читает буфер,
+    // поэтому копии итератора независимы и могут использоваться из разных потоков
+    class ConstIterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = Type;
+
+        ConstIterator() = default;
+
+        Type operator*() const noexcept {
+            assert(index_ < vector_->size_);
+            return values_[index_ % kGroupSize];
+        }
+
+        ConstIterator& operator++() noexcept {
+            ++index_;
+            if (index_ % kGroupSize == 0 && index_ < vector_->size_) {
+                vector_->DecodeGroup(index_, values_.data());
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept {
+            ConstIterator result(*this);
+            ++*this;
+            return result;
+        }
+
+        bool operator==(const ConstIterator& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        bool operator!=(const ConstIterator& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+    private:
+        friend class CompressedIntVector;
+
+        ConstIterator(const CompressedIntVector* vector, size_t index) noexcept :
+            vector_(vector),
+            index_(index)
+        {
+            if (index_ < vector_->size_) {
+                vector_->DecodeGroup(index_ - index_ % kGroupSize, values_.data());
+            }
+        }
+
+        const CompressedIntVector* vector_ = nullptr;
+        size_t index_ = 0;
+        std::array<Type, kGroupSize> values_{};
+    };
+
+private:
+    // Заголовок упакованного блока: минимум блока, смещение в words_ и число бит на элемент
+    struct Block {
+        Type base = 0;
+        size_t offset = 0;
+        uint8_t width = 0;
+    };
+
+    static constexpr unsigned kMaxWidth = std::numeric_limits<Type>::digits;
+    static constexpr size_t kGroupCount = kBlockSize / kGroupSize;
+
+    using UnpackFn = void (*)(const uint64_t*, Type, Type*);
+    using UnpackGroupTable = std::array<UnpackFn, kGroupCount>;
+
+    static uint64_t Unpack(const uint64_t* words, size_t index, unsigned width) noexcept {
+        if (width == 0) {
+            return 0;
+        }
+        const size_t position = index * width;
+        const unsigned shift = position % 64;
+        uint64_t value = words[position / 64] >> shift;
+        if (shift + width > 64) {
+            value |= words[position / 64 + 1] << (64 - shift);
+        }
+        return width == 64 ? value : value & ((uint64_t{1} << width) - 1);
+    }
+
+    // Извлекает значение с номером Index из блока значений шириной Width.
+    // Позиция значения в словах и сдвиг известны при компиляции
+    template <unsigned Width, size_t Index>
+    static uint64_t UnpackConstant(const uint64_t* words) noexcept {
+        if constexpr (Width == 0) {
+            return 0;
+        }
+        else {
+            constexpr size_t kPosition = Index * Width;
+            constexpr unsigned kShift = kPosition % 64;
+            uint64_t value = words[kPosition / 64] >> kShift;
+            if constexpr (kShift + Width > 64) {
+                value |= words[kPosition / 64 + 1] << (64 - kShift);
+            }
+            if constexpr (Width < 64) {
+                value &= (uint64_t{1} << Width) - 1;
+            }
+            return value;
+        }
+    }
+
+    // Распаковывает значения блока с номерами First + Indices в out[Indices]
+    template <unsigned Width, size_t First, size_t... Indices>
+    static void UnpackRange(const uint64_t* words, Type base, Type* out, std::index_sequence<Indices...>) noexcept {
+        ((out[Indices] = base + static_cast<Type>(UnpackConstant<Width, First + Indices>(words))), ...);
+    }
+
+    template <unsigned Width>
+    static void UnpackBlock(const uint64_t* words, Type base, Type* out) noexcept {
+        UnpackRange<Width, 0>(words, base, out, std::make_index_sequence<kBlockSize>{});
+    }
+
+    template <unsigned Width, size_t Group>
+    static void UnpackGroup(const uint64_t* words, Type base, Type* out) noexcept {
+        UnpackRange<Width, Group * kGroupSize>(words, base, out, std::make_index_sequence<kGroupSize>{});
+    }
+
+    template <size_t... Widths>
+    static constexpr std::array<UnpackFn, sizeof...(Widths)> MakeUnpackTable(std::index_sequence<Widths...>) {
+        return { &UnpackBlock<Widths>... };
+    }
+
+    template <unsigned Width, size_t... Groups>
+    static constexpr UnpackGroupTable MakeUnpackGroupRow(std::index_sequence<Groups...>) {
+        return { &UnpackGroup<Width, Groups>... };
+    }
+
+    template <size_t... Widths>
+    static constexpr std::array<UnpackGroupTable, sizeof...(Widths)> MakeUnpackGroupTable(std::index_sequence<Widths...>) {
+        return { MakeUnpackGroupRow<Widths>(std::make_index_sequence<kGroupCount>{})... };
+    }
+
+    static constexpr std::array<UnpackFn, kMaxWidth + 1> kUnpackTable =
+        MakeUnpackTable(std::make_index_sequence<kMaxWidth + 1>{});
+
+    static constexpr std::array<UnpackGroupTable, kMaxWidth + 1> kUnpackGroupTable =
+        MakeUnpackGroupTable(std::make_index_sequence<kMaxWidth + 1>{});
+
+    // Распаковывает kGroupSize элементов, начиная с index (кратного kGroupSize), в out.
+    // Группа из неполного последнего блока копируется из tail_
+    void DecodeGroup(size_t index, Type* out) const noexcept {
+        assert(index % kGroupSize == 0 && index < size_);
+        const size_t block_index = index / kBlockSize;
+        const size_t group = index % kBlockSize / kGroupSize;
+        if (block_index == blocks_.GetSize()) {
+            std::copy(tail_.begin() + group * kGroupSize, tail_.begin() + (group + 1) * kGroupSize, out);
+            return;
+        }
+        const Block& block = blocks_[block_index];
+        kUnpackGroupTable[block.width][group](words_.begin() + block.offset, block.base, out);
+    }
+
+    static unsigned BitWidth(uint64_t value) noexcept {
+        unsigned width = 0;
+        while (value != 0) {
+            value >>= 1;
+            ++width;
+        }
+        return width;
+    }
+
+    // Упаковывает заполненный несжатый блок и добавляет его в words_
+    void SealTail() {
+        const auto [min_it, max_it] = std::minmax_element(tail_.begin(), tail_.end());
+        Block block;
+        block.base = *min_it;
+        block.offset = words_.GetSize();
+        block.width = static_cast<uint8_t>(BitWidth(static_cast<uint64_t>(*max_it - *min_it)));
+
+        // kBlockSize * width бит занимают ровно 2 * width слов
+        for (size_t i = 0; i < kBlockSize * block.width / 64; ++i) {
+            words_.PushBack(0);
+        }
+        uint64_t* words = words_.begin() + block.offset;
+        for (size_t i = 0; i < kBlockSize && block.width != 0; ++i) {
+            const uint64_t value = static_cast<uint64_t>(tail_[i] - block.base);
+            const size_t position = i * block.width;
+            const unsigned shift = position % 64;
+            words[position / 64] |= value << shift;
+            if (shift + block.width > 64) {
+                words[position / 64 + 1] |= value >> (64 - shift);
+            }
+        }
+        blocks_.PushBack(block);
+    }
+
+    SimpleVector<uint64_t> words_;
+    SimpleVector<Block> blocks_;
+    std::array<Type, kBlockSize> tail_{};
+    size_t size_ = 0;
+};
+
+template <typename Type>
+inline bool operator==(const CompressedIntVector<Type>& lhs, const CompressedIntVector<Type>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type>
+inline bool operator!=(const CompressedIntVector<Type>& lhs, const CompressedIntVector<Type>& rhs) {
+    return !(lhs == rhs);
+}
@@ -1,9 +1,16 @@
 #include "simple_vector.h"
+#include "compressed_int_vector.h"
+#include "static_vector.h"
+#include "ring_buffer.h"
+#include "simple_vector_view.h"
+#include "vector_expression.h"
 
 #include <cassert>
 #include <iostream>
 #include <numeric>
 #include <string>
+#include <thread>
+#include <vector>
 #include "tests.h"
 
 int main() {
@@ -17,5 +24,12 @@ int main() {
     TestNoncopiablePushBack();
     TestNoncopiableInsert();
     TestNoncopiableErase();
+    TestCompressedIntVector();
+    TestStaticVector();
+    TestRingBuffer();
+    TestBufferPool();
+    TestSimpleVectorView();
+    TestVectorExpression();
+    TestParallelInit();
     return 0;
 }
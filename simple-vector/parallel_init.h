@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Как раздавать потокам части массива при параллельной инициализации.
+// Страница памяти попадает на узел NUMA того потока, который первым её записал
+enum class PagePlacement {
+    // Каждый поток инициализирует один непрерывный отрезок: данные потока лежат на его узле
+    kPartitioned,
+    // Части по chunk_bytes раздаются потокам по кругу: части чередуются между потоками.
+    // Часть попадает на узел записавшего её потока; сами узлы при раздаче не учитываются
+    kRoundRobin,
+};
+
+struct ParallelInitOptions {
+    // Число потоков; 0 — по числу аппаратных потоков
+    size_t thread_count = 0;
+    PagePlacement placement = PagePlacement::kPartitioned;
+    // Размер части в байтах, округляется до целого числа элементов
+    size_t chunk_bytes = size_t{1} << 21;
+    // Закреплять потоки за процессорами, равномерно распределяя их по доступным CPU,
+    // чтобы размещение страниц не зависело от планировщика
+    bool pin_threads = true;
+};
+
+// Часть массива и узел NUMA, на котором лежит её первая страница
+struct NumaChunk {
+    // Индекс первого элемента части
+    size_t offset = 0;
+    // Количество элементов в части
+    size_t size = 0;
+    // Номер узла либо -1, если его не удалось определить
+    int node = -1;
+};
+
+// Вызывает function(begin, end) для отрезков индексов [0, size) из нескольких потоков
+// согласно options. function не должна выбрасывать исключений.
+// Если очередной поток не удаётся запустить, его доля и доли оставшихся потоков
+// выполняются в вызывающем потоке. Исключение возможно только до первого вызова function
+template <typename Function>
+void ParallelForChunks(size_t size, size_t element_bytes, const ParallelInitOptions& options, Function function) {
+    const size_t chunk_size = std::max<size_t>(1, options.chunk_bytes / element_bytes);
+    const size_t chunk_count = (size + chunk_size - 1) / chunk_size;
+    size_t thread_count = options.thread_count != 0 ? options.thread_count : std::thread::hardware_concurrency();
+    thread_count = std::min(std::max<size_t>(thread_count, 1), chunk_count);
+    if (thread_count <= 1) {
+        if (size != 0) {
+            function(size_t{0}, size);
+        }
+        return;
+    }
+
+#ifdef __linux__
+    std::vector<int> cpus;
+    if (options.pin_threads) {
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &allowed)) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+    }
+#endif
+
+    const auto work = [&](size_t thread_index, [[maybe_unused]] bool pin) {
+#ifdef __linux__
+        if (pin && !cpus.empty()) {
+            cpu_set_t cpu_set;
+            CPU_ZERO(&cpu_set);
+            CPU_SET(cpus[thread_index * cpus.size() / thread_count], &cpu_set);
+            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        }
+#endif
+        if (options.placement == PagePlacement::kPartitioned) {
+            const size_t begin = thread_index * chunk_count / thread_count * chunk_size;
+            const size_t end = std::min(size, (thread_index + 1) * chunk_count / thread_count * chunk_size);
+            if (begin < end) {
+                function(begin, end);
+            }
+        }
+        else {
+            for (size_t chunk = thread_index; chunk < chunk_count; chunk += thread_count) {
+                function(chunk * chunk_size, std::min(size, (chunk + 1) * chunk_size));
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    size_t started = 0;
+    try {
+        for (; started < thread_count; ++started) {
+            threads.emplace_back(work, started, true);
+        }
+    }
+    catch (const std::system_error&) {
+        // Закрепление не применяется, чтобы не менять привязку вызывающего потока
+        for (size_t i = started; i < thread_count; ++i) {
+            work(i, false);
+        }
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+// Записывает в nodes[i] номер узла NUMA страницы, содержащей addresses[i], либо -1.
+// Страницы, которых ещё никто не касался, узла не имеют.
+// Возвращает false, если узлы узнать не удалось (ядро без поддержки NUMA, вызов запрещён
+// или недоступен на платформе); тогда все nodes[i] равны -1
+inline bool QueryNumaNodes([[maybe_unused]] const void* const* addresses, size_t count, int* nodes) {
+    std::fill(nodes, nodes + count, -1);
+#if defined(__linux__) && defined(SYS_move_pages)
+    if (count == 0) {
+        return true;
+    }
+    std::vector<void*> pages(count);
+    const uintptr_t page_mask = ~static_cast<uintptr_t>(sysconf(_SC_PAGESIZE) - 1);
+    for (size_t i = 0; i < count; ++i) {
+        pages[i] = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(addresses[i]) & page_mask);
+    }
+    std::vector<int> status(count, -1);
+    // move_pages без целевых узлов ничего не перемещает, а только сообщает текущий узел каждой страницы
+    if (syscall(SYS_move_pages, 0, count, pages.data(), nullptr, status.data(), 0) != 0) {
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        nodes[i] = status[i] >= 0 ? status[i] : -1;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include "array_ptr.h"
+
+// Размер кеш-линии, по которому разносятся индексы чтения и записи,
+// чтобы производитель и потребитель не делили одну линию
+inline constexpr size_t kCacheLineSize = 64;
+
+// Возвращает наименьшую степень двойки, не меньшую value
+inline size_t RoundUpToPowerOfTwo(size_t value) noexcept {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// Ограниченная кольцевая очередь для одного производителя и одного потребителя.
+// Все операции wait-free. Вместимость округляется вверх до степени двойки
+template <typename Type>
+class SpscRingBuffer {
+public:
+    explicit SpscRingBuffer(size_t capacity) :
+        capacity_(RoundUpToPowerOfTwo(capacity)),
+        mask_(capacity_ - 1),
+        buffer_(capacity_)
+    {
+    }
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    // Добавляет элемент. Возвращает false, если очередь заполнена.
+    // Вызывается только потоком-производителем
+    bool Push(Type value) {
+        return PushN(&value, 1) == 1;
+    }
+
+    // Извлекает элемент в value. Возвращает false, если очередь пуста.
+    // Вызывается только потоком-потребителем
+    bool Pop(Type& value) {
+        return PopN(&value, 1) == 1;
+    }
+
+    // Перемещает в очередь до count элементов из items одним или двумя непрерывными отрезками.
+    // Возвращает число помещённых элементов
+    size_t PushN(Type* items, size_t count) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (capacity_ - (tail - cached_head_) < count) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+        }
+        count = std::min(count, capacity_ - (tail - cached_head_));
+
+        const size_t start = tail & mask_;
+        const size_t first = std::min(count, capacity_ - start);
+        std::move(items, items + first, buffer_.Get() + start);
+        std::move(items + first, items + count, buffer_.Get());
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Перемещает из очереди в out до count элементов.
+    // Возвращает число извлечённых элементов
+    size_t PopN(Type* out, size_t count) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (cached_tail_ - head < count) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+        }
+        count = std::min(count, cached_tail_ - head);
+
+        const size_t start = head & mask_;
+        const size_t first = std::min(count, capacity_ - start);
+        std::move(buffer_.Get() + start, buffer_.Get() + start + first, out);
+        std::move(buffer_.Get(), buffer_.Get() + (count - first), out + first);
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    // Возвращает количество элементов. При одновременной работе потоков значение приблизительное
+    size_t GetSize() const noexcept {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    // Возвращает вместимость очереди
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+private:
+    const size_t capacity_;
+    const size_t mask_;
+    ArrayPtr<Type> buffer_;
+
+    // Линия потребителя: индекс чтения и последний прочитанный индекс записи
+    alignas(kCacheLineSize) std::atomic<size_t> head_{0};
+    size_t cached_tail_ = 0;
+
+    // Линия производителя: индекс записи и последний прочитанный индекс чтения
+    alignas(kCacheLineSize) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+};
+
+// Ограниченная lock-free очередь для нескольких производителей и потребителей.
+// Каждая ячейка хранит номер последовательности, по которому поток определяет,
+// свободна ли она для записи или заполнена для чтения.
+// Вместимость округляется вверх до степени двойки
+template <typename Type>
+class MpmcRingBuffer {
+public:
+    explicit MpmcRingBuffer(size_t capacity) :
+        capacity_(RoundUpToPowerOfTwo(capacity)),
+        mask_(capacity_ - 1),
+        cells_(capacity_)
+    {
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+    // Добавляет элемент. Возвращает false, если очередь заполнена
+    bool Push(Type value) {
+        return PushN(&value, 1) == 1;
+    }
+
+    // Извлекает элемент в value. Возвращает false, если очередь пуста
+    bool Pop(Type& value) {
+        return PopN(&value, 1) == 1;
+    }
+
+    // Резервирует одним CAS непрерывный отрезок свободных ячеек длиной до count
+    // и перемещает в него элементы из items. Возвращает число помещённых элементов
+    size_t PushN(Type* items, size_t count) {
+        size_t claimed = 0;
+        const size_t pos = Claim(enqueue_pos_, count, 0, claimed);
+        for (size_t i = 0; i < claimed; ++i) {
+            Cell& cell = cells_[(pos + i) & mask_];
+            cell.value = std::move(items[i]);
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    // Резервирует одним CAS непрерывный отрезок заполненных ячеек длиной до count
+    // и перемещает их в out. Возвращает число извлечённых элементов
+    size_t PopN(Type* out, size_t count) {
+        size_t claimed = 0;
+        const size_t pos = Claim(dequeue_pos_, count, 1, claimed);
+        for (size_t i = 0; i < claimed; ++i) {
+            Cell& cell = cells_[(pos + i) & mask_];
+            out[i] = std::move(cell.value);
+            cell.sequence.store(pos + i + capacity_, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    // Возвращает вместимость очереди
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Type value;
+    };
+
+    // Ячейка с номером pos готова, когда её sequence равен pos + lag:
+    // lag == 0 означает «свободна для записи», lag == 1 — «заполнена для чтения».
+    // Возвращает начало зарезервированного отрезка, его длину записывает в claimed
+    size_t Claim(std::atomic<size_t>& position, size_t count, size_t lag, size_t& claimed) {
+        size_t pos = position.load(std::memory_order_relaxed);
+        claimed = 0;
+        if (count == 0) {
+            return pos;
+        }
+        for (;;) {
+            size_t ready = 0;
+            while (ready < count && ready < capacity_
+                   && cells_[(pos + ready) & mask_].sequence.load(std::memory_order_acquire) == pos + ready + lag) {
+                ++ready;
+            }
+            if (ready == 0) {
+                const size_t sequence = cells_[pos & mask_].sequence.load(std::memory_order_acquire);
+                if (static_cast<std::intptr_t>(sequence - (pos + lag)) < 0) {
+                    // Очередь заполнена (для записи) или пуста (для чтения)
+                    return pos;
+                }
+                // Другой поток уже занял эту позицию
+                pos = position.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (position.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+                claimed = ready;
+                return pos;
+            }
+        }
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    ArrayPtr<Cell> cells_;
+
+    alignas(kCacheLineSize) std::atomic<size_t> enqueue_pos_{0};
+    alignas(kCacheLineSize) std::atomic<size_t> dequeue_pos_{0};
+};
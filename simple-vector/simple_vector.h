@@ -4,8 +4,14 @@
 #include <initializer_list>
 #include <stdexcept>
 #include <algorithm>
+#include <new>
+#include <type_traits>
 #include <utility>
 #include "array_ptr.h"
+#include "parallel_init.h"
+
+template <typename Derived>
+class VectorExpression;
 
 class ReserveProxyObj {
 public:
@@ -51,6 +57,41 @@ public:
         std::fill(begin(), end(), value);
     }
 
+    // Создаёт вектор из size элементов, инициализированных значением по умолчанию,
+    // параллельно в нескольких потоках. Каждая страница памяти оказывается на узле NUMA
+    // того потока, который её инициализировал (см. ParallelInitOptions)
+    SimpleVector(size_t size, const ParallelInitOptions& options) :
+        elements(size, [size, &options](Type* data) {
+            static_assert(std::is_nothrow_default_constructible_v<Type>,
+                          "parallel initialization requires a noexcept default constructor");
+            ParallelForChunks(size, sizeof(Type), options, [data](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    new (data + i) Type{};
+                }
+            });
+        }),
+        size_(size),
+        capacity_(size)
+    {
+    }
+
+    // Создаёт вектор из size элементов, инициализированных значением value,
+    // параллельно в нескольких потоках
+    SimpleVector(size_t size, const Type& value, const ParallelInitOptions& options) :
+        elements(size, [size, &value, &options](Type* data) {
+            static_assert(std::is_nothrow_copy_constructible_v<Type>,
+                          "parallel initialization requires a noexcept copy constructor");
+            ParallelForChunks(size, sizeof(Type), options, [data, &value](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    new (data + i) Type(value);
+                }
+            });
+        }),
+        size_(size),
+        capacity_(size)
+    {
+    }
+
     // Создаёт вектор из std::initializer_list
     SimpleVector(std::initializer_list<Type> init) :
         elements(init.size()),
@@ -74,6 +115,12 @@ public:
         std::move(tmp.begin(), tmp.end(), begin());
     }
 
+    // Создаёт вектор, вычисляя поэлементное выражение из vector_expression.h
+    template <typename Derived>
+    SimpleVector(const VectorExpression<Derived>& expression) {
+        AssignExpression(expression.Self());
+    }
+
     SimpleVector(ReserveProxyObj obj) :
         elements(obj.GetSize()),
         capacity_(obj.GetSize())
@@ -118,6 +165,13 @@ public:
         return *this;
     }
 
+    // Вычисляет поэлементное выражение из vector_expression.h одним проходом
+    template <typename Derived>
+    SimpleVector& operator=(const VectorExpression<Derived>& expression) {
+        AssignExpression(expression.Self());
+        return *this;
+    }
+
     // Добавляет элемент в конец вектора
     // При нехватке места увеличивает вдвое вместимость вектора
     void PushBack(const Type& item) {
@@ -236,7 +290,6 @@ public:
             size_ = new_size;
         }
         else if (new_size <= capacity_) {
-            }
             fill_vector(begin() + size_, begin() + new_size);
             size_ = new_size;
         }
@@ -250,6 +303,60 @@ public:
         }
     }
 
+    // Изменяет размер массива, инициализируя новые элементы параллельно в нескольких потоках.
+    // При перевыделении памяти в новый массив параллельно переносятся и старые элементы,
+    // так что все его страницы размещаются согласно options.
+    // Без перевыделения страницы уже размещены, и новые элементы заполняются в вызывающем потоке
+    void Resize(size_t new_size, const ParallelInitOptions& options) {
+        if (new_size <= capacity_) {
+            Resize(new_size);
+        }
+        else {
+            static_assert(std::is_nothrow_move_constructible_v<Type> && std::is_nothrow_default_constructible_v<Type>,
+                          "parallel initialization requires noexcept move and default constructors");
+            Type* old_data = begin();
+            const size_t old_size = size_;
+            ArrayPtr<Type> new_array(new_size, [new_size, old_data, old_size, &options](Type* data) {
+                ParallelForChunks(new_size, sizeof(Type), options, [data, old_data, old_size](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        if (i < old_size) {
+                            new (data + i) Type(std::move(old_data[i]));
+                        }
+                        else {
+                            new (data + i) Type{};
+                        }
+                    }
+                });
+            });
+            new_array.swap(elements);
+            size_ = new_size;
+            capacity_ = new_size;
+        }
+    }
+
+    // Возвращает части по chunk_size элементов и узлы NUMA, на которых лежат их первые страницы.
+    // Если узлы узнать не удалось, в numa_known записывается false, а все узлы равны -1
+    SimpleVector<NumaChunk> GetNumaPlacement(size_t chunk_size, bool* numa_known = nullptr) const {
+        assert(chunk_size != 0);
+        const size_t chunk_count = (size_ + chunk_size - 1) / chunk_size;
+        SimpleVector<NumaChunk> chunks(chunk_count);
+        SimpleVector<const void*> addresses(chunk_count);
+        SimpleVector<int> nodes(chunk_count);
+        for (size_t i = 0; i < chunk_count; ++i) {
+            chunks[i].offset = i * chunk_size;
+            chunks[i].size = std::min(chunk_size, size_ - chunks[i].offset);
+            addresses[i] = begin() + chunks[i].offset;
+        }
+        const bool known = QueryNumaNodes(addresses.begin(), chunk_count, nodes.begin());
+        if (numa_known != nullptr) {
+            *numa_known = known;
+        }
+        for (size_t i = 0; i < chunk_count; ++i) {
+            chunks[i].node = nodes[i];
+        }
+        return chunks;
+    }
+
     void fill_vector(Iterator start, Iterator end) {
         for (auto it = start; it != end; ++it) {
             Type value = Type{};
@@ -293,6 +400,29 @@ public:
         return elements.Get() + size_;
     }
 private:
+    // Вычисляет выражение на месте, если размер совпадает, иначе создаёт элементы
+    // из значений выражения в новой неинициализированной памяти без предварительного обнуления.
+    // Старый массив освобождается после вычисления, поэтому вектор может входить в выражение
+    template <typename Expression>
+    void AssignExpression(const Expression& expression) {
+        const size_t size = expression.GetSize();
+        if (size == size_) {
+            Type* out = begin();
+            for (size_t i = 0; i < size; ++i) {
+                out[i] = static_cast<Type>(expression[i]);
+            }
+            return;
+        }
+        ArrayPtr<Type> new_array(size, [&expression, size](Type* data) {
+            for (size_t i = 0; i < size; ++i) {
+                new (data + i) Type(static_cast<Type>(expression[i]));
+            }
+        });
+        elements.swap(new_array);
+        size_ = size;
+        capacity_ = size;
+    }
+
     ArrayPtr<Type> elements;
     size_t size_ = 0;
     size_t capacity_ = 0;
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "simple_vector.h"
+
+template <typename Type>
+class SimpleVectorChunks;
+
+// Невладеющее представление непрерывного отрезка элементов: указатель и длина.
+// SimpleVectorView<const Type> даёт доступ только на чтение.
+// Представление остаётся корректным, пока жив исходный массив и он не перевыделял память
+template <typename Type>
+class SimpleVectorView {
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    // Длина «до конца» для Subview
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    SimpleVectorView() noexcept = default;
+
+    SimpleVectorView(Type* data, size_t size) noexcept :
+        data_(data),
+        size_(size)
+    {
+    }
+
+    // Создаёт представление всех элементов вектора
+    SimpleVectorView(SimpleVector<std::remove_const_t<Type>>& vector) noexcept :
+        data_(vector.begin()),
+        size_(vector.GetSize())
+    {
+    }
+
+    // Создаёт представление константного вектора. Доступно только для SimpleVectorView<const Type>
+    template <typename T = Type, std::enable_if_t<std::is_const_v<T>, int> = 0>
+    SimpleVectorView(const SimpleVector<std::remove_const_t<Type>>& vector) noexcept :
+        data_(vector.begin()),
+        size_(vector.GetSize())
+    {
+    }
+
+    // Представление временного вектора сразу стало бы висячим
+    SimpleVectorView(SimpleVector<std::remove_const_t<Type>>&&) = delete;
+
+    // Преобразует изменяемое представление в константное
+    template <typename Other, std::enable_if_t<std::is_same_v<const Other, Type>
+                                               && !std::is_same_v<Other, Type>, int> = 0>
+    SimpleVectorView(SimpleVectorView<Other> other) noexcept :
+        data_(other.begin()),
+        size_(other.GetSize())
+    {
+    }
+
+    // Возвращает ссылку на элемент с индексом index
+    Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    // Возвращает ссылку на элемент с индексом index
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("too much");
+        }
+        return data_[index];
+    }
+
+    // Возвращает количество элементов
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    // Сообщает, пустое ли представление
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Возвращает представление count элементов, начиная с offset.
+    // Если count выходит за конец, берутся элементы до конца
+    // Выбрасывает исключение std::out_of_range, если offset > size
+    SimpleVectorView Subview(size_t offset, size_t count = npos) const {
+        if (offset > size_) {
+            throw std::out_of_range("too much");
+        }
+        return SimpleVectorView(data_ + offset, std::min(count, size_ - offset));
+    }
+
+    // Возвращает представление первых count элементов
+    // Выбрасывает исключение std::out_of_range, если count > size
+    SimpleVectorView First(size_t count) const {
+        if (count > size_) {
+            throw std::out_of_range("too much");
+        }
+        return SimpleVectorView(data_, count);
+    }
+
+    // Возвращает представление последних count элементов
+    // Выбрасывает исключение std::out_of_range, если count > size
+    SimpleVectorView Last(size_t count) const {
+        if (count > size_) {
+            throw std::out_of_range("too much");
+        }
+        return SimpleVectorView(data_ + (size_ - count), count);
+    }
+
+    // Разбивает представление на части по chunk_size элементов, последняя может быть короче.
+    // Части не копируют данные, их можно раздавать потокам или обрабатывать пакетами
+    // Выбрасывает исключение std::invalid_argument, если chunk_size == 0
+    SimpleVectorChunks<Type> Split(size_t chunk_size) const {
+        if (chunk_size == 0) {
+            throw std::invalid_argument("chunk size must be positive");
+        }
+        return SimpleVectorChunks<Type>(*this, chunk_size);
+    }
+
+    Iterator begin() const noexcept {
+        return data_;
+    }
+
+    Iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return data_;
+    }
+
+    ConstIterator cend() const noexcept {
+        return data_ + size_;
+    }
+
+private:
+    Type* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Последовательность частей одинакового размера, на которые разбито представление
+template <typename Type>
+class SimpleVectorChunks {
+public:
+    class ChunkIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SimpleVectorView<Type>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const SimpleVectorView<Type>*;
+        using reference = SimpleVectorView<Type>;
+
+        ChunkIterator() = default;
+
+        SimpleVectorView<Type> operator*() const noexcept {
+            return rest_.First(std::min(chunk_size_, rest_.GetSize()));
+        }
+
+        ChunkIterator& operator++() noexcept {
+            rest_ = rest_.Subview(std::min(chunk_size_, rest_.GetSize()));
+            return *this;
+        }
+
+        ChunkIterator operator++(int) noexcept {
+            ChunkIterator result(*this);
+            ++*this;
+            return result;
+        }
+
+        bool operator==(const ChunkIterator& rhs) const noexcept {
+            return rest_.begin() == rhs.rest_.begin() && rest_.GetSize() == rhs.rest_.GetSize();
+        }
+
+        bool operator!=(const ChunkIterator& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+    private:
+        friend class SimpleVectorChunks;
+
+        ChunkIterator(SimpleVectorView<Type> rest, size_t chunk_size) noexcept :
+            rest_(rest),
+            chunk_size_(chunk_size)
+        {
+        }
+
+        SimpleVectorView<Type> rest_;
+        size_t chunk_size_ = 0;
+    };
+
+    SimpleVectorChunks(SimpleVectorView<Type> view, size_t chunk_size) noexcept :
+        view_(view),
+        chunk_size_(chunk_size)
+    {
+        assert(chunk_size_ != 0);
+    }
+
+    // Возвращает количество частей
+    size_t GetSize() const noexcept {
+        return (view_.GetSize() + chunk_size_ - 1) / chunk_size_;
+    }
+
+    // Возвращает часть с индексом index
+    SimpleVectorView<Type> operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return view_.Subview(index * chunk_size_, chunk_size_);
+    }
+
+    ChunkIterator begin() const noexcept {
+        return ChunkIterator(view_, chunk_size_);
+    }
+
+    ChunkIterator end() const noexcept {
+        return ChunkIterator(view_.Last(0), chunk_size_);
+    }
+
+private:
+    SimpleVectorView<Type> view_;
+    size_t chunk_size_;
+};
+
+template <typename Type>
+SimpleVectorView(SimpleVector<Type>&) -> SimpleVectorView<Type>;
+
+template <typename Type>
+SimpleVectorView(const SimpleVector<Type>&) -> SimpleVectorView<const Type>;
+
+// Операции сравнения представлений между собой и с SimpleVector
+template <typename Lhs, typename Rhs>
+inline bool operator==(SimpleVectorView<Lhs> lhs, SimpleVectorView<Rhs> rhs) {
+    return (lhs.GetSize() == rhs.GetSize() && std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator!=(SimpleVectorView<Lhs> lhs, SimpleVectorView<Rhs> rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator<(SimpleVectorView<Lhs> lhs, SimpleVectorView<Rhs> rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator<=(SimpleVectorView<Lhs> lhs, SimpleVectorView<Rhs> rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator>(SimpleVectorView<Lhs> lhs, SimpleVectorView<Rhs> rhs) {
+    return rhs < lhs;
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator>=(SimpleVectorView<Lhs> lhs, SimpleVectorView<Rhs> rhs) {
+    return !(lhs < rhs);
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator==(const SimpleVector<Lhs>& lhs, SimpleVectorView<Rhs> rhs) {
+    return SimpleVectorView(lhs) == rhs;
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator!=(const SimpleVector<Lhs>& lhs, SimpleVectorView<Rhs> rhs) {
+    return SimpleVectorView(lhs) != rhs;
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator<(const SimpleVector<Lhs>& lhs, SimpleVectorView<Rhs> rhs) {
+    return SimpleVectorView(lhs) < rhs;
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator<=(const SimpleVector<Lhs>& lhs, SimpleVectorView<Rhs> rhs) {
+    return SimpleVectorView(lhs) <= rhs;
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator>(const SimpleVector<Lhs>& lhs, SimpleVectorView<Rhs> rhs) {
+    return SimpleVectorView(lhs) > rhs;
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator>=(const SimpleVector<Lhs>& lhs, SimpleVectorView<Rhs> rhs) {
+    return SimpleVectorView(lhs) >= rhs;
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator==(SimpleVectorView<Lhs> lhs, const SimpleVector<Rhs>& rhs) {
+    return lhs == SimpleVectorView(rhs);
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator!=(SimpleVectorView<Lhs> lhs, const SimpleVector<Rhs>& rhs) {
+    return lhs != SimpleVectorView(rhs);
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator<(SimpleVectorView<Lhs> lhs, const SimpleVector<Rhs>& rhs) {
+    return lhs < SimpleVectorView(rhs);
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator<=(SimpleVectorView<Lhs> lhs, const SimpleVector<Rhs>& rhs) {
+    return lhs <= SimpleVectorView(rhs);
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator>(SimpleVectorView<Lhs> lhs, const SimpleVector<Rhs>& rhs) {
+    return lhs > SimpleVectorView(rhs);
+}
+
+template <typename Lhs, typename Rhs>
+inline bool operator>=(SimpleVectorView<Lhs> lhs, const SimpleVector<Rhs>& rhs) {
+    return lhs >= SimpleVectorView(rhs);
+}
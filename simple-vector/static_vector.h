@@ -0,0 +1,378 @@
+#pragma once
+
+#include <cassert>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Хранилище StaticVector для тривиальных типов: обычный массив,
+// благодаря чему вектор можно использовать в constexpr-функциях
+template <typename Type, size_t N, bool = std::is_trivial_v<Type>>
+class StaticVectorStorage {
+protected:
+    constexpr Type* Data() noexcept {
+        return data_;
+    }
+
+    constexpr const Type* Data() const noexcept {
+        return data_;
+    }
+
+    template <typename... Args>
+    constexpr void Construct(size_t index, Args&&... args) {
+        data_[index] = Type(std::forward<Args>(args)...);
+    }
+
+    constexpr void Destroy(size_t) noexcept {
+    }
+
+    Type data_[N == 0 ? 1 : N]{};
+    size_t size_ = 0;
+};
+
+// Хранилище StaticVector для нетривиальных типов: сырая память,
+// в которой объекты создаются только для живых элементов
+template <typename Type, size_t N>
+class StaticVectorStorage<Type, N, false> {
+public:
+    StaticVectorStorage() noexcept = default;
+
+    StaticVectorStorage(const StaticVectorStorage& other) {
+        try {
+            for (; size_ < other.size_; ++size_) {
+                Construct(size_, other.Data()[size_]);
+            }
+        }
+        catch (...) {
+            DestroyAll();
+            throw;
+        }
+    }
+
+    StaticVectorStorage(StaticVectorStorage&& other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        if constexpr (std::is_nothrow_move_constructible_v<Type>) {
+            for (; size_ < other.size_; ++size_) {
+                Construct(size_, std::move(other.Data()[size_]));
+            }
+        }
+        else {
+            try {
+                for (; size_ < other.size_; ++size_) {
+                    Construct(size_, std::move(other.Data()[size_]));
+                }
+            }
+            catch (...) {
+                DestroyAll();
+                throw;
+            }
+        }
+    }
+
+    StaticVectorStorage& operator=(const StaticVectorStorage& rhs) {
+        if (this != &rhs) {
+            AssignFrom(rhs.Data(), rhs.size_, [](const Type& value) -> const Type& { return value; });
+        }
+        return *this;
+    }
+
+    StaticVectorStorage& operator=(StaticVectorStorage&& rhs) noexcept(std::is_nothrow_move_assignable_v<Type>
+                                                                       && std::is_nothrow_move_constructible_v<Type>) {
+        if (this != &rhs) {
+            AssignFrom(rhs.Data(), rhs.size_, [](Type& value) -> Type&& { return std::move(value); });
+        }
+        return *this;
+    }
+
+    ~StaticVectorStorage() {
+        DestroyAll();
+    }
+
+protected:
+    Type* Data() noexcept {
+        return std::launder(reinterpret_cast<Type*>(raw_));
+    }
+
+    const Type* Data() const noexcept {
+        return std::launder(reinterpret_cast<const Type*>(raw_));
+    }
+
+    template <typename... Args>
+    void Construct(size_t index, Args&&... args) {
+        new (raw_ + index * sizeof(Type)) Type(std::forward<Args>(args)...);
+    }
+
+    void Destroy(size_t index) noexcept {
+        Data()[index].~Type();
+    }
+
+    alignas(Type) unsigned char raw_[sizeof(Type) * (N == 0 ? 1 : N)];
+    size_t size_ = 0;
+
+private:
+    template <typename Source, typename Cast>
+    void AssignFrom(Source* source, size_t size, Cast cast) {
+        size_t i = 0;
+        for (; i < size && i < size_; ++i) {
+            Data()[i] = cast(source[i]);
+        }
+        for (; size_ < size; ++size_) {
+            Construct(size_, cast(source[size_]));
+        }
+        while (size_ > size) {
+            Destroy(--size_);
+        }
+    }
+
+    void DestroyAll() noexcept {
+        while (size_ > 0) {
+            Destroy(--size_);
+        }
+    }
+};
+
+// Вектор фиксированной вместимости N, хранящий элементы внутри себя без обращения к куче.
+// Превышение вместимости приводит к исключению std::length_error.
+// Для тривиальных типов все операции доступны в constexpr-контексте
+template <typename Type, size_t N>
+class StaticVector : private StaticVectorStorage<Type, N> {
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    constexpr StaticVector() noexcept = default;
+
+    // Создаёт вектор из size элементов, инициализированных значением по умолчанию
+    constexpr explicit StaticVector(size_t size) {
+        Resize(size);
+    }
+
+    // Создаёт вектор из size элементов, инициализированных значением value
+    constexpr StaticVector(size_t size, const Type& value) {
+        CheckCapacity(size);
+        for (; this->size_ < size; ++this->size_) {
+            this->Construct(this->size_, value);
+        }
+    }
+
+    // Создаёт вектор из std::initializer_list
+    constexpr StaticVector(std::initializer_list<Type> init) {
+        CheckCapacity(init.size());
+        for (const Type& elem : init) {
+            this->Construct(this->size_, elem);
+            ++this->size_;
+        }
+    }
+
+    // Возвращает ссылку на элемент с индексом index
+    constexpr Type& operator[](size_t index) noexcept {
+        assert(index < this->size_);
+        return this->Data()[index];
+    }
+
+    // Возвращает константную ссылку на элемент с индексом index
+    constexpr const Type& operator[](size_t index) const noexcept {
+        assert(index < this->size_);
+        return this->Data()[index];
+    }
+
+    // Возвращает ссылку на элемент с индексом index
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    constexpr Type& At(size_t index) {
+        if (index >= this->size_) {
+            throw std::out_of_range("too much");
+        }
+        return this->Data()[index];
+    }
+
+    // Возвращает константную ссылку на элемент с индексом index
+    // Выбрасывает исключение std::out_of_range, если index >= size
+    constexpr const Type& At(size_t index) const {
+        if (index >= this->size_) {
+            throw std::out_of_range("too much");
+        }
+        return this->Data()[index];
+    }
+
+    // Добавляет элемент в конец вектора
+    // Выбрасывает исключение std::length_error, если вектор заполнен
+    constexpr void PushBack(const Type& item) {
+        CheckCapacity(this->size_ + 1);
+        this->Construct(this->size_, item);
+        ++this->size_;
+    }
+
+    constexpr void PushBack(Type&& item) {
+        CheckCapacity(this->size_ + 1);
+        this->Construct(this->size_, std::move(item));
+        ++this->size_;
+    }
+
+    // Вставляет значение value в позицию pos.
+    // Возвращает итератор на вставленное значение
+    // Выбрасывает исключение std::length_error, если вектор заполнен
+    constexpr Iterator Insert(ConstIterator pos, const Type& value) {
+        return Insert(pos, Type(value));
+    }
+
+    constexpr Iterator Insert(ConstIterator pos, Type&& value) {
+        assert(pos >= begin());
+        assert(pos <= end());
+        CheckCapacity(this->size_ + 1);
+        const size_t index = pos - begin();
+        Type* data = this->Data();
+        if (index == this->size_) {
+            this->Construct(this->size_, std::move(value));
+            ++this->size_;
+        }
+        else {
+            this->Construct(this->size_, std::move(data[this->size_ - 1]));
+            ++this->size_;
+            for (size_t i = this->size_ - 2; i > index; --i) {
+                data[i] = std::move(data[i - 1]);
+            }
+            data[index] = std::move(value);
+        }
+        return begin() + index;
+    }
+
+    // "Удаляет" последний элемент вектора. Вектор не должен быть пустым
+    constexpr void PopBack() noexcept {
+        assert(!IsEmpty());
+        this->Destroy(--this->size_);
+    }
+
+    // Удаляет элемент вектора в указанной позиции
+    constexpr Iterator Erase(ConstIterator pos) {
+        assert(pos >= begin());
+        assert(pos < end());
+        const size_t index = pos - begin();
+        Type* data = this->Data();
+        for (size_t i = index; i + 1 < this->size_; ++i) {
+            data[i] = std::move(data[i + 1]);
+        }
+        PopBack();
+        return begin() + index;
+    }
+
+    // Обменивает значение с другим вектором
+    constexpr void swap(StaticVector& other) {
+        StaticVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    // Возвращает количество элементов в массиве
+    constexpr size_t GetSize() const noexcept {
+        return this->size_;
+    }
+
+    // Возвращает вместимость массива
+    constexpr size_t GetCapacity() const noexcept {
+        return N;
+    }
+
+    // Сообщает, пустой ли массив
+    constexpr bool IsEmpty() const noexcept {
+        return this->size_ == 0;
+    }
+
+    // Удаляет все элементы
+    constexpr void Clear() noexcept {
+        while (!IsEmpty()) {
+            PopBack();
+        }
+    }
+
+    // Изменяет размер массива.
+    // При увеличении размера новые элементы получают значение по умолчанию для типа Type
+    // Выбрасывает исключение std::length_error, если new_size > N
+    constexpr void Resize(size_t new_size) {
+        CheckCapacity(new_size);
+        while (this->size_ > new_size) {
+            PopBack();
+        }
+        for (; this->size_ < new_size; ++this->size_) {
+            this->Construct(this->size_);
+        }
+    }
+
+    constexpr Iterator begin() noexcept {
+        return this->Data();
+    }
+
+    constexpr Iterator end() noexcept {
+        return this->Data() + this->size_;
+    }
+
+    constexpr ConstIterator begin() const noexcept {
+        return this->Data();
+    }
+
+    constexpr ConstIterator end() const noexcept {
+        return this->Data() + this->size_;
+    }
+
+    constexpr ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    constexpr ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    static constexpr void CheckCapacity(size_t size) {
+        if (size > N) {
+            throw std::length_error("StaticVector capacity exceeded");
+        }
+    }
+};
+
+// Операции сравнения написаны циклами, так как алгоритмы <algorithm> в C++17 не constexpr
+template <typename Type, size_t N>
+constexpr bool operator==(const StaticVector<Type, N>& lhs, const StaticVector<Type, N>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.GetSize(); ++i) {
+        if (!(lhs[i] == rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Type, size_t N>
+constexpr bool operator!=(const StaticVector<Type, N>& lhs, const StaticVector<Type, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N>
+constexpr bool operator<(const StaticVector<Type, N>& lhs, const StaticVector<Type, N>& rhs) {
+    for (size_t i = 0; i < lhs.GetSize() && i < rhs.GetSize(); ++i) {
+        if (lhs[i] < rhs[i]) {
+            return true;
+        }
+        if (rhs[i] < lhs[i]) {
+            return false;
+        }
+    }
+    return lhs.GetSize() < rhs.GetSize();
+}
+
+template <typename Type, size_t N>
+constexpr bool operator<=(const StaticVector<Type, N>& lhs, const StaticVector<Type, N>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t N>
+constexpr bool operator>(const StaticVector<Type, N>& lhs, const StaticVector<Type, N>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t N>
+constexpr bool operator>=(const StaticVector<Type, N>& lhs, const StaticVector<Type, N>& rhs) {
+    return !(lhs < rhs);
+}
@@ -369,4 +369,557 @@ inline void Test2() {
         v.Erase(v.cbegin() + 2);
         assert((v == SimpleVector<int>{1, 2, 4}));
     }
-}
\ No newline at end of file
+}
+
+void TestCompressedIntVector() {
+    cout << "Test compressed int vector"s << endl;
+    //     
+    {
+        const size_t size = 100000;
+        SimpleVector<uint64_t> source;
+        for (size_t i = 0; i < size; ++i) {
+            source.PushBack(1'000'000'000'000 + i * 3);
+        }
+        CompressedIntVector<uint64_t> compressed(source);
+        assert(compressed.GetSize() == size);
+        for (size_t i = 0; i < size; ++i) {
+            assert(compressed[i] == source[i]);
+        }
+        size_t i = 0;
+        for (uint64_t value : compressed) {
+            assert(value == source[i++]);
+        }
+        assert(i == size);
+        assert(compressed.ToSimpleVector() == source);
+
+        //  ,    , -  
+        auto it = compressed.begin();
+        for (size_t j = 0; j + 1 < CompressedIntVector<uint64_t>::kBlockSize; ++j) {
+            ++it;
+        }
+        auto last_in_block = it++;
+        assert(*it == source[CompressedIntVector<uint64_t>::kBlockSize]);
+        assert(*last_in_block == source[CompressedIntVector<uint64_t>::kBlockSize - 1]);
+        assert(*it == source[CompressedIntVector<uint64_t>::kBlockSize]);
+
+        //  begin() ,     
+        const auto first = compressed.begin();
+        vector<thread> threads;
+        std::atomic<size_t> mismatches = 0;
+        for (size_t t = 0; t < 2; ++t) {
+            threads.emplace_back([&, t] {
+                auto current = first;
+                for (size_t j = 0; j < size; ++j, ++current) {
+                    if (j % 2 == t && *current != source[j]) {
+                        ++mismatches;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        assert(mismatches == 0);
+        assert(compressed.GetMemoryUsage() * 4 < size * sizeof(uint64_t));
+    }
+
+    // ,   64 ,     
+    {
+        CompressedIntVector<uint64_t> compressed;
+        const size_t block = CompressedIntVector<uint64_t>::kBlockSize;
+        for (size_t i = 0; i < block; ++i) {
+            compressed.PushBack(i % 2 == 0 ? 0 : numeric_limits<uint64_t>::max());
+        }
+        for (size_t i = 0; i < block + 5; ++i) {
+            compressed.PushBack(7);
+        }
+        assert(compressed[1] == numeric_limits<uint64_t>::max());
+        assert(compressed[2] == 0);
+        assert(compressed[block + 3] == 7);
+        assert(compressed[2 * block + 4] == 7);
+        try {
+            compressed.At(compressed.GetSize());
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+    }
+    cout << "Done!"s << endl << endl;
+}
+
+constexpr int SumStaticVector() {
+    StaticVector<int, 8> v{ 1, 2, 3 };
+    v.PushBack(4);
+    v.Insert(v.begin(), 10);
+    v.Erase(v.begin() + 1);
+    v.Resize(6);
+    int sum = 0;
+    for (int value : v) {
+        sum += value;
+    }
+    return sum;
+}
+
+class LiveCounter {
+public:
+    LiveCounter() {
+        ++live_;
+    }
+    LiveCounter(const LiveCounter&) {
+        ++live_;
+    }
+    LiveCounter& operator=(const LiveCounter&) = default;
+    ~LiveCounter() {
+        --live_;
+    }
+    static int GetLive() {
+        return live_;
+    }
+
+private:
+    static inline int live_ = 0;
+};
+
+void TestStaticVector() {
+    cout << "Test static vector"s << endl;
+    //   constexpr-
+    {
+        static_assert(SumStaticVector() == 10 + 2 + 3 + 4);
+        constexpr StaticVector<int, 4> v{ 1, 2, 3 };
+        static_assert(v.GetSize() == 3 && v[2] == 3);
+        static_assert((StaticVector<int, 4>{ 1, 2 } < StaticVector<int, 4>{ 1, 3 }));
+    }
+
+    //      
+    {
+        {
+            StaticVector<LiveCounter, 16> v(3);
+            assert(LiveCounter::GetLive() == 3);
+            v.PushBack(LiveCounter());
+            assert(LiveCounter::GetLive() == 4);
+            v.Erase(v.begin());
+            assert(LiveCounter::GetLive() == 3);
+            StaticVector<LiveCounter, 16> copy(v);
+            assert(LiveCounter::GetLive() == 6);
+            copy.Resize(1);
+            assert(LiveCounter::GetLive() == 4);
+        }
+        assert(LiveCounter::GetLive() == 0);
+    }
+
+    //  
+    {
+        StaticVector<X, 8> v;
+        for (size_t i = 0; i < 5; ++i) {
+            v.PushBack(X(i));
+        }
+        v.Insert(v.begin() + 2, X(42));
+        assert(v[2].GetX() == 42);
+        assert(v[3].GetX() == 2);
+        auto it = v.Erase(v.begin());
+        assert(it->GetX() == 1);
+        StaticVector<X, 8> moved(move(v));
+        assert(moved.GetSize() == 5);
+        assert((moved.end() - 1)->GetX() == 4);
+    }
+
+    //     
+    {
+        StaticVector<string, 2> v{ "a"s, "b"s };
+        try {
+            v.PushBack("c"s);
+            assert(false);
+        }
+        catch (const std::length_error&) {
+        }
+        try {
+            v.At(2);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+        assert(v.GetSize() == 2);
+        assert((v == StaticVector<string, 2>{ "a"s, "b"s }));
+
+        //      noexcept-    
+        static_assert(is_nothrow_move_constructible_v<StaticVector<string, 2>>);
+        StaticVector<string, 2> moved(move(v));
+        assert((moved == StaticVector<string, 2>{ "a"s, "b"s }));
+    }
+    cout << "Done!"s << endl << endl;
+}
+
+template <typename RingBuffer>
+void CheckRingBufferSingleThread() {
+    RingBuffer buffer(5);
+    assert(buffer.GetCapacity() == 8);
+    int value = 0;
+    assert(!buffer.Pop(value));
+
+    //         
+    int items[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    int out[8] = {};
+    assert(buffer.PushN(items, 6) == 6);
+    assert(buffer.PopN(out, 4) == 4);
+    assert(out[0] == 1 && out[3] == 4);
+    assert(buffer.PushN(items, 8) == 6);
+    assert(!buffer.Push(100));
+    assert(buffer.PopN(out, 8) == 8);
+    assert(out[0] == 5 && out[1] == 6 && out[2] == 1 && out[7] == 6);
+    assert(!buffer.Pop(value));
+    assert(buffer.Push(100));
+    assert(buffer.Pop(value) && value == 100);
+}
+
+template <typename RingBuffer>
+void CheckRingBufferThreads(size_t producers, size_t consumers) {
+    const int per_producer = 100000;
+    RingBuffer buffer(64);
+    std::atomic<long long> sum = 0;
+    std::atomic<int> consumed = 0;
+    const int total = per_producer * static_cast<int>(producers);
+    vector<thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&buffer] {
+            int batch[16];
+            for (int i = 0; i < per_producer;) {
+                const int count = std::min(16, per_producer - i);
+                for (int j = 0; j < count; ++j) {
+                    batch[j] = i + j + 1;
+                }
+                int pushed = 0;
+                while (pushed < count) {
+                    const size_t n = buffer.PushN(batch + pushed, count - pushed);
+                    if (n == 0) {
+                        this_thread::yield();
+                    }
+                    pushed += static_cast<int>(n);
+                }
+                i += count;
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            int batch[16];
+            while (consumed.load() < total) {
+                const size_t count = buffer.PopN(batch, 16);
+                if (count == 0) {
+                    this_thread::yield();
+                }
+                for (size_t j = 0; j < count; ++j) {
+                    sum += batch[j];
+                }
+                consumed += static_cast<int>(count);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    assert(consumed == total);
+    assert(sum == static_cast<long long>(producers) * per_producer * (per_producer + 1) / 2);
+}
+
+void TestRingBuffer() {
+    cout << "Test ring buffer"s << endl;
+    CheckRingBufferSingleThread<SpscRingBuffer<int>>();
+    CheckRingBufferSingleThread<MpmcRingBuffer<int>>();
+    CheckRingBufferThreads<SpscRingBuffer<int>>(1, 1);
+    CheckRingBufferThreads<MpmcRingBuffer<int>>(4, 4);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestBufferPool() {
+    cout << "Test buffer pool"s << endl;
+    BufferPool& pool = BufferPool::Instance();
+    pool.Enable(true);
+
+    //          
+    {
+        const size_t size = 1000;
+        const BufferPoolStats before = pool.GetStats();
+        const int* first_data = nullptr;
+        for (int i = 0; i < 10; ++i) {
+            SimpleVector<int> v = GenerateVector(size);
+            assert(v[size - 1] == static_cast<int>(size));
+            if (first_data == nullptr) {
+                first_data = v.begin();
+            }
+            assert(v.begin() == first_data);
+        }
+        const BufferPoolStats after = pool.GetStats();
+        assert(after.misses - before.misses == 1);
+        assert(after.hits - before.hits == 9);
+    }
+
+    //           
+    {
+        {
+            SimpleVector<string> v(3);
+            v[0] = "dirty"s;
+        }
+        SimpleVector<string> v(3);
+        assert(v[0].empty());
+        SimpleVector<int> numbers(5, 7);
+        numbers.Resize(100);
+        assert(numbers[4] == 7 && numbers[99] == 0);
+    }
+
+    //    ,  Trim   
+    {
+        BufferPoolOptions options;
+        options.max_local_blocks = 0;
+        pool.SetOptions(options);
+        {
+            SimpleVector<int> v(100);
+        }
+        assert(pool.GetStats().global_bytes > 0);
+        pool.Trim();
+        assert(pool.GetStats().global_bytes == 0);
+        pool.SetOptions(BufferPoolOptions{});
+    }
+
+    //       max_local_bytes,     
+    {
+        BufferPoolOptions options;
+        options.max_local_bytes = 1024;
+        pool.SetOptions(options);
+        {
+            SimpleVector<int> small(100);
+            SimpleVector<int> large(1000);
+        }
+        const BufferPoolStats stats = pool.GetStats();
+        assert(stats.local_bytes == 512);
+        assert(stats.global_bytes == 4096);
+        pool.Trim();
+        assert(pool.GetStats().local_bytes == 0);
+        pool.SetOptions(BufferPoolOptions{});
+    }
+
+    // Trim            
+    {
+        std::atomic<int> stage = 0;
+        size_t cached_bytes = 0;
+        size_t trimmed_bytes = 0;
+        thread worker([&] {
+            {
+                SimpleVector<int> v(100);
+            }
+            cached_bytes = pool.GetStats().local_bytes;
+            stage = 1;
+            while (stage != 2) {
+                this_thread::yield();
+            }
+            trimmed_bytes = pool.GetStats().local_bytes;
+        });
+        while (stage != 1) {
+            this_thread::yield();
+        }
+        pool.Trim();
+        stage = 2;
+        worker.join();
+        assert(cached_bytes == 512);
+        assert(trimmed_bytes == 0);
+        assert(pool.GetStats().global_bytes == 0);
+    }
+
+    // Release  ,    delete[],      
+    {
+        ArrayPtr<int> pooled(10);
+        pooled[3] = 5;
+        int* released = pooled.Release();
+        assert(!pooled && released[3] == 5);
+        delete[] released;
+
+        ArrayPtr<string> raw(2, [](string* data) {
+            new (data) string("first"s);
+            new (data + 1) string("second"s);
+        });
+        string* strings = raw.Release();
+        assert(!raw && strings[1] == "second"s);
+        delete[] strings;
+    }
+
+    pool.Trim();
+    pool.Enable(false);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSimpleVectorView() {
+    cout << "Test simple vector view"s << endl;
+    //        
+    {
+        SimpleVector<int> v = GenerateVector(10);
+        SimpleVectorView<int> view(v);
+        assert(view.begin() == v.begin());
+        assert(view.GetSize() == v.GetSize());
+        SimpleVectorView<int> middle = view.Subview(2, 3);
+        assert(middle.GetSize() == 3 && middle[0] == 3);
+        middle[0] = 42;
+        assert(v[2] == 42);
+        sort(middle.begin(), middle.end());
+        assert(v[2] == 4 && v[4] == 42);
+        assert(view.Subview(8).GetSize() == 2);
+        assert(view.Subview(5, 100).GetSize() == 5);
+        assert(view.First(2) == (SimpleVector<int>{ 1, 2 }));
+        assert((SimpleVector<int>{ 9, 10 }) == view.Last(2));
+        try {
+            view.Subview(11);
+            assert(false);
+        }
+        catch (const std::out_of_range&) {
+        }
+    }
+
+    //    
+    {
+        const SimpleVector<int> v{ 1, 2, 3, 4 };
+        SimpleVectorView view(v);
+        static_assert(is_same_v<decltype(view), SimpleVectorView<const int>>);
+        SimpleVector<int> other{ 1, 2, 3 };
+        SimpleVectorView<const int> other_view = SimpleVectorView<int>(other);
+        assert(view.First(3) == other_view);
+        assert(other_view < view);
+        assert(view > other);
+        assert(view != other);
+        assert(accumulate(view.begin(), view.end(), 0) == 10);
+    }
+
+    //   
+    {
+        SimpleVector<int> v = GenerateVector(10);
+        auto chunks = SimpleVectorView<int>(v).Split(4);
+        assert(chunks.GetSize() == 3);
+        assert(chunks[2].GetSize() == 2 && chunks[2][0] == 9);
+        size_t count = 0;
+        int sum = 0;
+        for (SimpleVectorView<int> chunk : chunks) {
+            assert(chunk.begin() == v.begin() + count * 4);
+            sum += accumulate(chunk.begin(), chunk.end(), 0);
+            ++count;
+        }
+        assert(count == 3 && sum == 55);
+        assert(SimpleVectorView<int>().Split(4).GetSize() == 0);
+    }
+    cout << "Done!"s << endl << endl;
+}
+
+void TestVectorExpression() {
+    cout << "Test vector expression"s << endl;
+    //       
+    {
+        const SimpleVector<double> b{ 1.0, 2.0, 3.0 };
+        const SimpleVector<double> c{ 4.0, 5.0, 6.0 };
+        const SimpleVector<double> d{ 0.5, 0.5, 0.5 };
+        SimpleVector<double> a = b * c + d;
+        assert((a == SimpleVector<double>{ 4.5, 10.5, 18.5 }));
+
+        //         
+        const double* data = a.begin();
+        a = (a - 0.5) / 2.0;
+        assert(a.begin() == data);
+        assert((a == SimpleVector<double>{ 2.0, 5.0, 9.0 }));
+
+        //     ,   
+        SimpleVector<double> e{ 1.0 };
+        e = a + e[0];
+        assert((e == SimpleVector<double>{ 3.0, 6.0, 10.0 }));
+
+        Assign(a, 10.0 - -b);
+        assert((a == SimpleVector<double>{ 11.0, 12.0, 13.0 }));
+    }
+
+    //    
+    {
+        const SimpleVector<int> v{ -3, 1, 4 };
+        SimpleVector<int> abs_v = Abs(v);
+        assert((abs_v == SimpleVector<int>{ 3, 1, 4 }));
+        SimpleVector<int> clamped = Max(Min(v, 2), 0);
+        assert((clamped == SimpleVector<int>{ 0, 1, 2 }));
+        SimpleVector<double> halves = v / 2.0;
+        assert((halves == SimpleVector<double>{ -1.5, 0.5, 2.0 }));
+        auto expression = Abs(v) * v;
+        assert(expression.GetSize() == 3 && expression[0] == -9);
+    }
+    cout << "Done!"s << endl << endl;
+}
+
+void TestParallelInit() {
+    cout << "Test parallel initialization"s << endl;
+    ParallelInitOptions options;
+    options.thread_count = 4;
+    options.chunk_bytes = 4096;
+
+    //   
+    {
+        const size_t size = 100000;
+        SimpleVector<int> v(size, options);
+        assert(v.GetSize() == size && v.GetCapacity() == size);
+        assert(all_of(v.begin(), v.end(), [](int value) { return value == 0; }));
+
+        options.placement = PagePlacement::kRoundRobin;
+        SimpleVector<int> filled(size, 42, options);
+        assert(all_of(filled.begin(), filled.end(), [](int value) { return value == 42; }));
+    }
+
+    //      
+    {
+        SimpleVector<int> v = GenerateVector(5000);
+        v.Resize(20000, options);
+        assert(v.GetSize() == 20000);
+        assert(v[4999] == 5000 && v[5000] == 0 && v[19999] == 0);
+        v.Resize(100, options);
+        v.Resize(15000, options);
+        assert(v[99] == 100 && v[100] == 0 && v[14999] == 0);
+
+        SimpleVector<string> strings(3);
+        strings[2] = "kept"s;
+        strings.Resize(10000, options);
+        assert(strings[2] == "kept"s && strings[9999].empty());
+    }
+
+    //       
+    {
+        try {
+            ArrayPtr<int> array(1000, [](int*) {
+                throw std::runtime_error("init failed");
+            });
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+    }
+
+    //       NUMA
+    {
+        SimpleVector<int> v(10000, options);
+        bool numa_known = false;
+        SimpleVector<NumaChunk> chunks = v.GetNumaPlacement(4096, &numa_known);
+        assert(chunks.GetSize() == 3);
+        assert(chunks[2].offset == 8192 && chunks[2].size == 10000 - 8192);
+        //  ,     :  NUMA  
+        //    move_pages     -1
+        if (numa_known) {
+            // ,   ,  
+            for (const NumaChunk& chunk : chunks) {
+                assert(chunk.node >= 0);
+            }
+
+            //  ,    ,  
+            const size_t untouched_bytes = size_t{1} << 26;
+            void* untouched = ::operator new(untouched_bytes);
+            const void* address = static_cast<char*>(untouched) + untouched_bytes / 2;
+            int node = 0;
+            const bool queried = QueryNumaNodes(&address, 1, &node);
+            ::operator delete(untouched);
+            assert(queried && node == -1);
+        }
+        else {
+            for (const NumaChunk& chunk : chunks) {
+                assert(chunk.node == -1);
+            }
+        }
+    }
+    cout << "Done!"s << endl << endl;
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "simple_vector.h"
+
+// Ленивые поэлементные выражения над SimpleVector арифметических типов.
+// Операторы + - * / и функции Abs, Min, Max не вычисляют ничего сами, а строят дерево выражения,
+// которое вычисляется одним циклом при присваивании в SimpleVector или вызове Assign.
+// Выражение хранит указатели на данные векторов-операндов и не должно их переживать
+
+// Базовый класс всех узлов выражения
+template <typename Derived>
+class VectorExpression {
+public:
+    const Derived& Self() const noexcept {
+        return static_cast<const Derived&>(*this);
+    }
+};
+
+// Лист выражения: элементы SimpleVector
+template <typename Type>
+class VectorOperand : public VectorExpression<VectorOperand<Type>> {
+public:
+    using ValueType = Type;
+
+    explicit VectorOperand(const SimpleVector<Type>& vector) noexcept :
+        data_(vector.begin()),
+        size_(vector.GetSize())
+    {
+    }
+
+    Type operator[](size_t index) const noexcept {
+        return data_[index];
+    }
+
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+private:
+    const Type* data_;
+    size_t size_;
+};
+
+// Лист выражения: число, одинаковое для всех позиций. Размера не имеет
+template <typename Type>
+class ScalarOperand : public VectorExpression<ScalarOperand<Type>> {
+public:
+    using ValueType = Type;
+
+    explicit ScalarOperand(Type value) noexcept :
+        value_(value)
+    {
+    }
+
+    Type operator[](size_t) const noexcept {
+        return value_;
+    }
+
+private:
+    Type value_;
+};
+
+template <typename Type>
+inline constexpr bool kIsScalarOperand = false;
+
+template <typename Type>
+inline constexpr bool kIsScalarOperand<ScalarOperand<Type>> = true;
+
+template <typename Operation, typename Operand>
+class UnaryExpression : public VectorExpression<UnaryExpression<Operation, Operand>> {
+public:
+    using ValueType = decltype(Operation{}(std::declval<typename Operand::ValueType>()));
+
+    explicit UnaryExpression(Operand operand) noexcept :
+        operand_(operand)
+    {
+    }
+
+    ValueType operator[](size_t index) const noexcept {
+        return Operation{}(operand_[index]);
+    }
+
+    size_t GetSize() const noexcept {
+        return operand_.GetSize();
+    }
+
+private:
+    Operand operand_;
+};
+
+template <typename Operation, typename Lhs, typename Rhs>
+class BinaryExpression : public VectorExpression<BinaryExpression<Operation, Lhs, Rhs>> {
+public:
+    using ValueType = decltype(Operation{}(std::declval<typename Lhs::ValueType>(),
+                                           std::declval<typename Rhs::ValueType>()));
+
+    BinaryExpression(Lhs lhs, Rhs rhs) noexcept :
+        lhs_(lhs),
+        rhs_(rhs)
+    {
+        if constexpr (!kIsScalarOperand<Lhs> && !kIsScalarOperand<Rhs>) {
+            assert(lhs_.GetSize() == rhs_.GetSize());
+        }
+    }
+
+    ValueType operator[](size_t index) const noexcept {
+        return Operation{}(lhs_[index], rhs_[index]);
+    }
+
+    size_t GetSize() const noexcept {
+        if constexpr (kIsScalarOperand<Lhs>) {
+            return rhs_.GetSize();
+        }
+        else {
+            return lhs_.GetSize();
+        }
+    }
+
+private:
+    Lhs lhs_;
+    Rhs rhs_;
+};
+
+struct AbsOperation {
+    template <typename Type>
+    Type operator()(Type value) const noexcept {
+        if constexpr (std::is_unsigned_v<Type>) {
+            return value;
+        }
+        else {
+            return value < Type{} ? -value : value;
+        }
+    }
+};
+
+struct MinOperation {
+    template <typename Lhs, typename Rhs>
+    auto operator()(Lhs lhs, Rhs rhs) const noexcept {
+        using Result = std::common_type_t<Lhs, Rhs>;
+        return rhs < lhs ? static_cast<Result>(rhs) : static_cast<Result>(lhs);
+    }
+};
+
+struct MaxOperation {
+    template <typename Lhs, typename Rhs>
+    auto operator()(Lhs lhs, Rhs rhs) const noexcept {
+        using Result = std::common_type_t<Lhs, Rhs>;
+        return lhs < rhs ? static_cast<Result>(rhs) : static_cast<Result>(lhs);
+    }
+};
+
+// Приведение аргументов операторов к узлам выражения
+template <typename Type>
+inline constexpr bool kIsElementwiseVector = false;
+
+template <typename Type>
+inline constexpr bool kIsElementwiseVector<SimpleVector<Type>> = std::is_arithmetic_v<Type>;
+
+template <typename Type>
+inline constexpr bool kIsElementwiseExpression = kIsElementwiseVector<Type> || std::is_base_of_v<VectorExpression<Type>, Type>;
+
+template <typename Lhs, typename Rhs>
+inline constexpr bool kIsElementwisePair =
+    (kIsElementwiseExpression<Lhs> && (kIsElementwiseExpression<Rhs> || std::is_arithmetic_v<Rhs>))
+    || (std::is_arithmetic_v<Lhs> && kIsElementwiseExpression<Rhs>);
+
+template <typename Type>
+VectorOperand<Type> ToOperand(const SimpleVector<Type>& vector) noexcept {
+    return VectorOperand<Type>(vector);
+}
+
+template <typename Derived>
+const Derived& ToOperand(const VectorExpression<Derived>& expression) noexcept {
+    return expression.Self();
+}
+
+template <typename Type, std::enable_if_t<std::is_arithmetic_v<Type>, int> = 0>
+ScalarOperand<Type> ToOperand(Type value) noexcept {
+    return ScalarOperand<Type>(value);
+}
+
+template <typename Type>
+using OperandType = std::decay_t<decltype(ToOperand(std::declval<const Type&>()))>;
+
+template <typename Operation, typename Lhs, typename Rhs>
+BinaryExpression<Operation, OperandType<Lhs>, OperandType<Rhs>> MakeBinaryExpression(const Lhs& lhs, const Rhs& rhs) {
+    return BinaryExpression<Operation, OperandType<Lhs>, OperandType<Rhs>>(ToOperand(lhs), ToOperand(rhs));
+}
+
+template <typename Lhs, typename Rhs, std::enable_if_t<kIsElementwisePair<Lhs, Rhs>, int> = 0>
+auto operator+(const Lhs& lhs, const Rhs& rhs) {
+    return MakeBinaryExpression<std::plus<>>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs, std::enable_if_t<kIsElementwisePair<Lhs, Rhs>, int> = 0>
+auto operator-(const Lhs& lhs, const Rhs& rhs) {
+    return MakeBinaryExpression<std::minus<>>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs, std::enable_if_t<kIsElementwisePair<Lhs, Rhs>, int> = 0>
+auto operator*(const Lhs& lhs, const Rhs& rhs) {
+    return MakeBinaryExpression<std::multiplies<>>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs, std::enable_if_t<kIsElementwisePair<Lhs, Rhs>, int> = 0>
+auto operator/(const Lhs& lhs, const Rhs& rhs) {
+    return MakeBinaryExpression<std::divides<>>(lhs, rhs);
+}
+
+template <typename Operand, std::enable_if_t<kIsElementwiseExpression<Operand>, int> = 0>
+auto operator-(const Operand& operand) {
+    return UnaryExpression<std::negate<>, OperandType<Operand>>(ToOperand(operand));
+}
+
+// Поэлементный модуль
+template <typename Operand, std::enable_if_t<kIsElementwiseExpression<Operand>, int> = 0>
+auto Abs(const Operand& operand) {
+    return UnaryExpression<AbsOperation, OperandType<Operand>>(ToOperand(operand));
+}
+
+// Поэлементный минимум; один из аргументов может быть числом
+template <typename Lhs, typename Rhs, std::enable_if_t<kIsElementwisePair<Lhs, Rhs>, int> = 0>
+auto Min(const Lhs& lhs, const Rhs& rhs) {
+    return MakeBinaryExpression<MinOperation>(lhs, rhs);
+}
+
+// Поэлементный максимум; один из аргументов может быть числом
+template <typename Lhs, typename Rhs, std::enable_if_t<kIsElementwisePair<Lhs, Rhs>, int> = 0>
+auto Max(const Lhs& lhs, const Rhs& rhs) {
+    return MakeBinaryExpression<MaxOperation>(lhs, rhs);
+}
+
+// Вычисляет выражение одним проходом и записывает результат в destination.
+// Если размер destination совпадает с размером выражения, память не выделяется,
+// иначе элементы создаются сразу из значений выражения в неинициализированной памяти.
+// destination может входить в выражение: каждый элемент читается до записи на его место
+template <typename Type, typename Derived>
+void Assign(SimpleVector<Type>& destination, const VectorExpression<Derived>& expression) {
+    destination = expression;
+}